@@ -0,0 +1,84 @@
+/*
+ * Benchmark of the AST, parsing Tokens into its arena, walking every Node, and freeing it; and how much heap it holds
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#ifdef __GLIBC__
+    #include <malloc.h>
+#endif
+
+#include "bench.hpp"
+
+#include "lib/ast-parser.hpp"
+#include "lib/tokeniser.hpp"
+
+/**
+ * \brief How much of the heap is in use, if the C library can say
+ *
+ * \return The bytes allocated and not yet freed, or 0 if unknown
+ */
+static std::size_t heap_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * \brief A visitor counting every Node it enters
+ */
+struct Counter {
+    std::size_t nodes = 0;
+
+    void enter(const AST &, const AST::Visit &) {
+        this->nodes++;
+    }
+
+    void leave(const AST &, const AST::Visit &) {}
+};
+
+int main(int argc, char *argv[]) {
+    std::string input = bench_input(argc, argv, "<input>");
+
+    Tokeniser tokeniser(input);
+    TokenBuffer tokens = tokeniser.run();
+
+    bool errors = false;
+    double parse = best_of([&]() {
+        AST_Parser parser(&tokens);
+        AST tree = parser.run();
+        errors = parser.had_error();
+    });
+
+    std::size_t before = heap_in_use();
+    AST tree = AST_Parser(&tokens).run();
+    std::size_t held = heap_in_use() - before;
+
+    Counter counter;
+    double walk = best_of([&]() {
+        counter = Counter();
+        tree.walk(counter);
+    });
+
+    // Only freeing is timed, so each run parses a tree of its own first
+    double free = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        std::unique_ptr<AST> doomed = std::make_unique<AST>(AST_Parser(&tokens).run());
+        auto start = std::chrono::steady_clock::now();
+        doomed.reset();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        free = 0 == run ? elapsed : std::min(free, elapsed);
+    }
+
+    std::cout << std::fixed << std::setprecision(2) << "  AST               " << tree.size() << " Nodes; parse " << parse * 1e3 << " ms, walk "
+              << walk * 1e3 << " ms (" << counter.nodes << " Nodes visited)" << '\n'
+              << "                    heap held " << held / 1024 << " KiB" << (0 == held ? " (unknown here)" : "") << ", free "
+              << free * 1e3 << " ms" << '\n';
+
+    return errors ? 1 : 0;
+}
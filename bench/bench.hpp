@@ -0,0 +1,63 @@
+/**
+ * \file bench.hpp
+ * \author Gnomeball
+ * \brief A file outlining the helpers shared by every benchmark
+ * \version 0.1
+ * \date 2026-10-18
+ */
+
+#ifndef BENCH
+#define BENCH
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+/**
+ * \brief How many times each benchmark runs the work it measures; the fastest run is the one reported
+ */
+constexpr int BENCH_RUNS = 5;
+
+/**
+ * \brief Times some work, running it several times and keeping the fastest run
+ *
+ * The first run, when nothing is in the cache, and the SymbolTable has yet to hold any of the spellings
+ * the work interns, is rarely the fastest, so it is simply outrun rather than being treated specially.
+ *
+ * \param work Runs the work once
+ * \param runs How many times to run it
+ *
+ * \return The fastest run, in seconds
+ */
+template <typename Work>
+double best_of(Work &&work, int runs = BENCH_RUNS) {
+    double best = 0;
+    for (int run = 0; run < runs; run++) {
+        auto start = std::chrono::steady_clock::now();
+        work();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = 0 == run ? elapsed : std::min(best, elapsed);
+    }
+    return best;
+}
+
+/**
+ * \brief Reads the input a benchmark was given, exiting with usage if there isn't one
+ *
+ * \param argc How many arguments the benchmark was given
+ * \param argv The argument values
+ * \param usage What the benchmark expects
+ *
+ * \return The path of the input
+ */
+inline std::string bench_input(int argc, char *argv[], const char *usage) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " " << usage << '\n';
+        std::exit(2);
+    }
+    return argv[1];
+}
+
+#endif
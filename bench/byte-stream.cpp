@@ -0,0 +1,45 @@
+/*
+ * Benchmark of walking the Bytes of a ByteStream, against the same Bytes held in a std::list, as they once were
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <list>
+
+#include "bench.hpp"
+
+#include "lib/parser.hpp"
+#include "lib/tokeniser.hpp"
+
+/**
+ * \brief Reads every Byte, folding each into a sum so that no read can be left out
+ */
+template <typename Bytes>
+static std::uint64_t sum(const Bytes &bytes) {
+    std::uint64_t total = 0;
+    for (const Byte &byte : bytes) {
+        total += static_cast<std::uint64_t>(byte.get_op()) + static_cast<std::uint64_t>(byte.get_constant());
+    }
+    return total;
+}
+
+int main(int argc, char *argv[]) {
+    std::string input = bench_input(argc, argv, "<input>");
+
+    Tokeniser tokeniser(input);
+    TokenBuffer tokens = tokeniser.run();
+    Parser parser(&tokens);
+    ByteStream stream = parser.run();
+    std::list<Byte> list(stream.begin(), stream.end());
+
+    std::uint64_t totals[2] = {};
+    double walk_stream = best_of([&]() { totals[0] = sum(stream); });
+    double walk_list = best_of([&]() { totals[1] = sum(list); });
+
+    std::cout << std::fixed << std::setprecision(2) << "  ByteStream walk   " << stream.size() << " Bytes in " << stream.encoded_size() / 1024 << " KiB, "
+              << walk_stream * 1e3 << " ms" << '\n'
+              << "  std::list walk    " << list.size() << " Bytes in " << list.size() * (sizeof(Byte) + 2 * sizeof(void *)) / 1024 << " KiB or more, "
+              << walk_list * 1e3 << " ms" << (totals[0] == totals[1] ? "" : ", NOT the same Bytes") << '\n';
+
+    return totals[0] == totals[1] ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/*
+ * Benchmark of whole compiles, from source to assembly, through every stage against fused into the Parser
+ */
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "bench.hpp"
+
+#include "lib/codegen.hpp"
+#include "lib/compiler.hpp"
+#include "lib/direct-codegen.hpp"
+#include "lib/parser.hpp"
+#include "lib/tackify.hpp"
+#include "lib/tokeniser.hpp"
+
+/**
+ * \brief How many times a set of inputs is compiled in one run, so that small inputs take long enough to time; a
+ * single input is taken to be large enough already, and compiled once
+ */
+constexpr int PASSES = 200;
+
+/**
+ * \brief Compiles a file through Bytes, Tacky, and Assembly, as main does by default
+ *
+ * \return true if it compiled
+ */
+static bool staged(const std::string &input, const std::string &output) {
+    TokenBuffer tokens = Tokeniser(input).run();
+    Parser parser(&tokens);
+    ByteStream bytes = parser.run();
+    if (parser.had_error() || tokens.had_error()) {
+        return false;
+    }
+
+    Tackify tackify(&bytes);
+    std::list<Tacky> tacky = tackify.run();
+    Compiler assembler(&tacky);
+    std::list<Assembly> assembly = assembler.run();
+    if (tackify.had_error() || assembler.had_error()) {
+        return false;
+    }
+
+    Codegen codegen(&assembly, output);
+    codegen.generate();
+    return true;
+}
+
+/**
+ * \brief Compiles a file straight to assembly as it is parsed, as main does with -fused
+ *
+ * \return true if it compiled
+ */
+static bool fused(const std::string &input, const std::string &output) {
+    TokenBuffer tokens = Tokeniser(input).run();
+    Parser<DirectCodegen> parser(&tokens);
+    DirectCodegen codegen = parser.run();
+    if (parser.had_error() || tokens.had_error() || codegen.had_error()) {
+        return false;
+    }
+
+    codegen.generate(output);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    std::string scratch = bench_input(argc, argv, "<output directory> <input>...");
+    std::vector<std::string> inputs(argv + 2, argv + argc);
+    int passes = inputs.size() > 1 ? PASSES : 1;
+
+    bool compiled = true;
+    auto compile_all = [&](auto compile, const char *suffix) {
+        return best_of([&]() {
+            for (int pass = 0; pass < passes; pass++) {
+                for (const std::string &input : inputs) {
+                    std::string name = input.substr(input.find_last_of('/') + 1);
+                    std::string output = scratch + "/" + name.substr(0, name.find_last_of('.')) + suffix;
+
+                    // Rewriting a file in place can make the filesystem write it out at once, so each is written afresh
+                    std::remove((output + ".asm").c_str());
+                    compiled = compile(input, output) && compiled;
+                }
+            }
+        });
+    };
+
+    double through_stages = compile_all(staged, ".staged");
+    double through_parser = compile_all(fused, ".fused");
+    double files = static_cast<double>(passes) * inputs.size();
+
+    std::cout << std::fixed << std::setprecision(1) << "  Staged            " << files / through_stages << " files/s, " << through_stages / files * 1e6
+              << " us a file" << '\n'
+              << "  Fused             " << files / through_parser << " files/s, " << through_parser / files * 1e6 << " us a file, "
+              << through_stages / through_parser << "x" << (compiled ? "" : ", with errors") << '\n';
+
+    return compiled ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+import argparse
+import random
+
+parser = argparse.ArgumentParser(prog='generate', description='Writes a generated benchmark input to stdout')
+
+OPERATORS = ['+', '-', '*', '/', '%', '<<', '>>', '&', '|', '^', '==', '!=', '<', '<=', '>', '>=', '&&', '||']
+NAMES = ['value', 'count', 'x', 'total_size', 'index', 'a1', '_next', 'buffer_length']
+
+def setup_args():
+    parser.add_argument('kind', help='What to generate', choices=['source', 'lines', 'chain'])
+    parser.add_argument('size', help='How large to make it; see each kind for the unit', type=int)
+
+    return parser.parse_args()
+
+def source_line():
+    # One indented line of keywords, identifiers, constants in several bases, and operators
+    terms = []
+    for _ in range(random.randint(2, 8)):
+        r = random.random()
+        if r < 0.4: terms.append(random.choice(NAMES))
+        elif r < 0.6: terms.append(str(random.randint(0, 99999)))
+        elif r < 0.7: terms.append(hex(random.randint(0, 0xffffff)) + random.choice(['', 'u', 'L']))
+        else: terms.append('(' + random.choice(NAMES) + ' ' + random.choice(OPERATORS) + ' ' + str(random.randint(1, 9)) + ')')
+    return '    ' + random.choice(['return ', 'int ' + random.choice(NAMES) + ' = ']) + (' ' + random.choice(OPERATORS) + ' ').join(terms) + ';'
+
+def source(megabytes):
+    # Lexer input: lines as above, until the input is large enough; it is only meant to be tokenised, so needn't parse
+    random.seed(2)
+    lines = []
+    length = 0
+    while length < megabytes * 1024 * 1024:
+        line = source_line()
+        lines.append(line)
+        length += len(line) + 1
+    print('int main(void) {\n' + '\n'.join(lines) + '\n}')
+
+def lines(count):
+    # Lexer input: the same lines, but a given number of them, for benchmarks that edit one line at a time
+    random.seed(2)
+    print('int main(void) {\n' + '\n'.join(source_line() for _ in range(count)) + '\n}')
+
+def chain(operators):
+    # Parser input: one long random chain of binary operators, with some unary operators and parentheses mixed in
+    random.seed(7)
+    out = []
+    depth = 0
+    for _ in range(operators):
+        r = random.random()
+        if r < 0.15: out.append(random.choice(['-', '~', '!']))
+        if r > 0.85:
+            out.append('(')
+            depth += 1
+        out.append(str(random.randint(1, 999)))
+        if depth and random.random() < 0.15:
+            out.append(')')
+            depth -= 1
+        out.append(random.choice(OPERATORS))
+    out.append('1' + ')' * depth)
+    print('int main(void) { return ' + ' '.join(out) + '; }')
+
+def main():
+    args = setup_args()
+
+    {'source': source, 'lines': lines, 'chain': chain}[args.kind](args.size)
+
+main()
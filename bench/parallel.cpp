@@ -0,0 +1,54 @@
+/*
+ * Benchmark of Tokeniser::run_parallel(), at each thread count given, checking every result is what run() finds
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "bench.hpp"
+
+#include "lib/tokeniser.hpp"
+
+/**
+ * \brief Used to check if two TokenBuffers hold the same Tokens
+ */
+static bool same_tokens(const TokenBuffer &a, const TokenBuffer &b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); i++) {
+        Token x = a[i];
+        Token y = b[i];
+        if (x.get_type() != y.get_type() || x.get_offset() != y.get_offset() || x.get_length() != y.get_length() || x.get_payload() != y.get_payload()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    std::string input = bench_input(argc, argv, "<input> <threads>...");
+
+    Tokeniser reference(input);
+    TokenBuffer expected = reference.run();
+    double megabytes = reference.source().length() / 1e6;
+
+    std::cout << "  " << std::thread::hardware_concurrency() << " hardware threads available; "
+              << expected.size() << " Tokens" << '\n';
+
+    for (int i = 2; i < argc; i++) {
+        unsigned threads = std::stoul(argv[i]);
+        bool same = true;
+
+        double best = best_of([&]() {
+            Tokeniser tokeniser(input);
+            same = same && same_tokens(expected, tokeniser.run_parallel(threads));
+        });
+
+        std::cout << std::fixed << std::setprecision(1) << "  run_parallel(" << threads << ")   " << best * 1e3 << " ms, "
+                  << megabytes / best << " MB/s, " << (same ? "same Tokens as run()" : "NOT the same Tokens as run()") << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+/*
+ * Benchmark of the Parser, parsing Tokens that have already been found into Bytes
+ */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+
+#include "lib/parser.hpp"
+#include "lib/tokeniser.hpp"
+
+int main(int argc, char *argv[]) {
+    std::string input = bench_input(argc, argv, "<input>");
+
+    Tokeniser tokeniser(input);
+    TokenBuffer tokens = tokeniser.run();
+
+    std::size_t count = 0;
+    bool errors = false;
+
+    double best = best_of([&]() {
+        Parser parser(&tokens);
+        ByteStream bytes = parser.run();
+        count = bytes.size();
+        errors = parser.had_error();
+    });
+
+    std::cout << std::fixed << std::setprecision(1) << "  Parser::run       " << tokens.size() << " Tokens into " << count << " Bytes, "
+              << best * 1e3 << " ms, " << tokens.size() / best / 1e6 << " M Tokens/s" << (errors ? ", with errors" : "") << '\n';
+
+    return errors ? 1 : 0;
+}
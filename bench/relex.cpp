@@ -0,0 +1,62 @@
+/*
+ * Benchmark of Tokeniser::relex, bringing the Tokens of a large input up to date after editing one line of it
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+#include "lib/tokeniser.hpp"
+
+/**
+ * \brief How many lines are edited in one run; each is rewritten, then put back, so the input is the same for every run
+ */
+constexpr int EDITS = 1000;
+
+int main(int argc, char *argv[]) {
+    std::string input = bench_input(argc, argv, "<input>");
+
+    double full = best_of([&]() { Tokeniser(input).run(); });
+
+    Tokeniser tokeniser(input);
+    TokenBuffer tokens = tokeniser.run();
+
+    // The first edit to a mapped input copies all of it, which every later edit is spared, so it is timed on its own
+    double first = best_of([&]() { tokeniser.relex(tokens, { 0, 0, "" }); }, 1);
+
+    std::vector<std::size_t> line_starts = { 0 };
+    const SourceBuffer &source = tokeniser.source();
+    for (const char *c = source.begin(); c != source.end(); c++) {
+        if ('\n' == *c) {
+            line_starts.push_back(c - source.begin() + 1);
+        }
+    }
+
+    const std::string_view replacement = "    int value = other << 2;";
+    std::size_t rescanned = 0;
+
+    double best = best_of([&]() {
+        std::mt19937 random(5);
+        rescanned = 0;
+        for (int edit = 0; edit < EDITS; edit++) {
+            std::size_t line = random() % (line_starts.size() - 1);
+            std::size_t offset = line_starts[line];
+            std::string original(source.begin() + offset, line_starts[line + 1] - 1 - offset);
+
+            rescanned += tokeniser.relex(tokens, { offset, original.size(), replacement });
+            rescanned += tokeniser.relex(tokens, { offset, replacement.size(), original });
+        }
+    });
+
+    std::cout << std::fixed << std::setprecision(1) << "  Tokeniser::run    " << tokens.size() << " Tokens, " << line_starts.size() - 1 << " lines, "
+              << full * 1e3 << " ms" << '\n'
+              << "  First edit        " << first * 1e3 << " ms, copying the mapped input" << '\n'
+              << "  Tokeniser::relex  " << best / (2 * EDITS) * 1e6 << " us an edit, " << static_cast<double>(rescanned) / (2 * EDITS)
+              << " Tokens scanned again an edit, " << full / (best / (2 * EDITS)) << "x faster than run()"
+              << (tokeniser.had_error() ? ", with errors" : "") << '\n';
+
+    return tokeniser.had_error() ? 1 : 0;
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+
+# Builds and runs every benchmark, optimised, on generated inputs
+#
+# Inputs are generated once into obj/bench, and kept for later runs; `make clean` removes them.
+# The benchmarks are built into bin/bench, with $CXX (clang++ unless given).
+
+set -e
+
+CXX=${CXX:-clang++}
+CXXFLAGS="-std=c++17 -O2 -pthread -Isrc"
+
+cd "$(dirname "$0")/.."
+mkdir -p obj/bench bin/bench
+
+# build <benchmark>
+build() {
+    $CXX $CXXFLAGS "bench/$1.cpp" -o "bin/bench/$1"
+}
+
+# generate <name> <kind> <size>
+generate() {
+    if [ ! -f "obj/bench/$1" ]; then
+        python3 bench/generate.py "$2" "$3" > "obj/bench/$1"
+    fi
+}
+
+echo "Tokeniser, on a 30 MiB generated input"
+generate source.c source 30
+build tokeniser
+bin/bench/tokeniser obj/bench/source.c
+
+echo
+echo "Tokeniser::run_parallel, on a 50 MiB generated input"
+generate source-50.c source 50
+build parallel
+bin/bench/parallel obj/bench/source-50.c 1 2 4 8
+
+echo
+echo "Tokeniser::relex, editing one line at a time of a 100k line generated input"
+generate lines.c lines 100000
+build relex
+bin/bench/relex obj/bench/lines.c
+
+echo
+echo "Parser, on a generated chain of 500k operators"
+generate chain.c chain 500000
+build parser
+bin/bench/parser obj/bench/chain.c
+
+echo
+echo "AST, on the same chain"
+build ast
+bin/bench/ast obj/bench/chain.c
+
+echo
+echo "Walking Bytes, on the same chain"
+build byte-stream
+bin/bench/byte-stream obj/bench/chain.c
+
+echo
+echo "Whole compiles, staged and fused, on the test inputs that compile, each 200 times"
+build fused
+bin/bench/fused obj/bench tests/inputs/c*.c
+
+echo
+echo "Whole compiles, staged and fused, on the same chain"
+bin/bench/fused obj/bench obj/bench/chain.c
@@ -0,0 +1,29 @@
+/*
+ * Benchmark of the Tokeniser, lexing a whole input with run()
+ */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+
+#include "lib/tokeniser.hpp"
+
+int main(int argc, char *argv[]) {
+    std::string input = bench_input(argc, argv, "<input>");
+
+    std::size_t count = 0;
+    std::size_t length = 0;
+
+    double best = best_of([&]() {
+        Tokeniser tokeniser(input);
+        TokenBuffer tokens = tokeniser.run();
+        count = tokens.size();
+        length = tokeniser.source().length();
+    });
+
+    std::cout << std::fixed << std::setprecision(1) << "  Tokeniser::run    " << count << " Tokens, " << length / (1024 * 1024) << " MiB, "
+              << best * 1e3 << " ms, " << count / best / 1e6 << " M Tokens/s" << '\n';
+
+    return 0;
+}
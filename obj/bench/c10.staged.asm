@@ -0,0 +1,25 @@
+    .text
+    .file   "obj/bench/c10.staged.c"
+    .globl  _main
+
+_main:  ## @main            # -- Begin function main
+
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $12, %rsp
+    movl    $3, -4(%rbp)
+    notl    -4(%rbp)
+    movl    -4(%rbp), %r10d
+    movl    %r10d, -8(%rbp)
+    notl    -8(%rbp)
+    movl    -8(%rbp), %r10d
+    movl    %r10d, -12(%rbp)
+    notl    -12(%rbp)
+    movl    -12(%rbp), %eax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+        ## -- End function main
+
+    .ident  "A Very Gnomish C Compiler"
@@ -0,0 +1,19 @@
+    .text
+    .file   "obj/bench/c4.staged.c"
+    .globl  _main
+
+_main:  ## @main            # -- Begin function main
+
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $4, %rsp
+    movl    $2, -4(%rbp)
+    negl    -4(%rbp)
+    movl    -4(%rbp), %eax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+        ## -- End function main
+
+    .ident  "A Very Gnomish C Compiler"
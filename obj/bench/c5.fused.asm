@@ -0,0 +1,19 @@
+    .text
+    .file   "obj/bench/c5.fused.c"
+    .globl  _main
+
+_main:  ## @main            # -- Begin function main
+
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $4, %rsp
+    movl    $-2, -4(%rbp)
+    notl    -4(%rbp)
+    movl    -4(%rbp), %eax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+        ## -- End function main
+
+    .ident  "A Very Gnomish C Compiler"
@@ -0,0 +1,12 @@
+    .text
+    .file   "obj/bench/c6.staged.c"
+    .globl  _main
+
+_main:  ## @main            # -- Begin function main
+
+    movl    $2, %eax
+    ret
+
+        ## -- End function main
+
+    .ident  "A Very Gnomish C Compiler"